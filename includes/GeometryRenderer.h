@@ -1,7 +1,7 @@
 #ifndef GEOMETRYRENDERER_H
 #define GEOMETRYRENDERER_H
 
-#include <vector>
+#include <span>
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -15,8 +15,9 @@ struct GeometryConfig
         glm::vec2 texCoord;
     };
 
-    std::vector<Vertex> vertices;
-    std::vector<unsigned int> indices;
+    // Non-owning views; the backing storage only has to outlive Initialize()
+    std::span<const Vertex> vertices;
+    std::span<const unsigned int> indices;
     const char* vertexShader;
     const char* fragmentShader;
     unsigned int initialWidth;
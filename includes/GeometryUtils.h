@@ -2,18 +2,47 @@
 #define GEOMETRYUTILS_H
 
 #include "GeometryRenderer.h"
+#include <span>
 #include <vector>
 #include <glm/glm.hpp>
 
 namespace GeometryUtils 
 {
+    // Reusable CPU-side storage for one generated mesh at a time.
+    // Two vectors that are cleared and refilled, so their capacity carries over.
+    class GeometryArena
+    {
+        public:
+        GeometryArena() = default;
+        GeometryArena(GeometryArena&&) = default;
+        GeometryArena(const GeometryArena&) = delete;
+
+        GeometryArena& operator=(GeometryArena&&) = default;
+        GeometryArena& operator=(const GeometryArena&) = delete;
+
+        // Discard the previous contents and reserve room for count elements
+        std::vector<GeometryConfig::Vertex>& AcquireVertices(size_t count);
+        std::vector<unsigned int>& AcquireIndices(size_t count);
+
+        // Both invalidate every SphereGeometry/GeometryConfig built from this arena.
+        // Reset() keeps the capacity for the next mesh, Release() frees it.
+        void Reset();
+        void Release();
+
+        private:
+        std::vector<GeometryConfig::Vertex> mVertices;
+        std::vector<unsigned int> mIndices;
+    };
+
+    // Views into the arena the sphere was generated in. They stay valid only until
+    // the next GenerateSphere(), Reset() or Release() on that same arena.
     struct SphereGeometry 
     {
-        std::vector<GeometryConfig::Vertex> vertices;
-        std::vector<unsigned int> indices;
+        std::span<const GeometryConfig::Vertex> vertices;
+        std::span<const unsigned int> indices;
     };
 
-    SphereGeometry GenerateSphere(float radius, int sectors, int stacks);
+    SphereGeometry GenerateSphere(GeometryArena& arena, float radius, int sectors, int stacks);
 }
 
 #endif
@@ -4,11 +4,12 @@
 #include "GeometryRenderer.h"
 #include "GeometryUtils.h"
 
-// Function to create a sphere configuration
-inline GeometryConfig createSphereConfig() 
+// Function to create a sphere configuration.
+// The returned config views memory owned by arena, keep it alive until Initialize() returns.
+inline GeometryConfig createSphereConfig(GeometryUtils::GeometryArena& arena) 
 {
     // Generate sphere geometry data
-    auto sphere = GeometryUtils::GenerateSphere(1.0f, 128, 128);
+    auto sphere = GeometryUtils::GenerateSphere(arena, 1.0f, 128, 128);
 
     GeometryConfig config;
     config.vertices = sphere.vertices,
@@ -85,7 +86,4 @@ inline GeometryConfig createSphereConfig()
     return config;
 }
 
-// Declare the sphere configuration as an inline constant to ensure proper linkage
-inline const GeometryConfig sphereConfig = createSphereConfig();
-
 #endif
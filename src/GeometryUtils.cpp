@@ -3,9 +3,45 @@
 
 namespace GeometryUtils
 {
-    SphereGeometry GenerateSphere(float radius, int sectors, int stacks) 
+    std::vector<GeometryConfig::Vertex>& GeometryArena::AcquireVertices(size_t count)
+    {
+        mVertices.clear();
+        mVertices.reserve(count);
+        return mVertices;
+    }
+
+    std::vector<unsigned int>& GeometryArena::AcquireIndices(size_t count)
+    {
+        mIndices.clear();
+        mIndices.reserve(count);
+        return mIndices;
+    }
+
+    void GeometryArena::Reset()
+    {
+        mVertices.clear();
+        mIndices.clear();
+    }
+
+    void GeometryArena::Release()
+    {
+        // swap with empty vectors, clear() alone keeps the capacity
+        std::vector<GeometryConfig::Vertex>().swap(mVertices);
+        std::vector<unsigned int>().swap(mIndices);
+    }
+
+    SphereGeometry GenerateSphere(GeometryArena& arena, float radius, int sectors, int stacks) 
     {  
-        SphereGeometry geometry;
+        // Degenerate input, nothing to generate
+        if (sectors < 1 || stacks < 1)
+            return SphereGeometry{};
+
+        // Exact sizes up front so push_back never reallocates
+        const size_t vertexCount = static_cast<size_t>(stacks + 1) * (sectors + 1);
+        const size_t indexCount = stacks > 1 ? static_cast<size_t>(6) * sectors * (stacks - 1) : 0;
+
+        auto& vertices = arena.AcquireVertices(vertexCount);
+        auto& indices = arena.AcquireIndices(indexCount);
 
         const float PI = glm::pi<float>();
         const float TAU = 2.0f * PI;
@@ -30,7 +66,7 @@ namespace GeometryUtils
                 vertex.texCoord.x = static_cast<float>(sector) / sectors;
                 vertex.texCoord.y = static_cast<float>(stack) / stacks;
                 
-                geometry.vertices.push_back(vertex);
+                vertices.push_back(vertex);
             }
         }
 
@@ -45,7 +81,7 @@ namespace GeometryUtils
                 // First triangle (k1, k2, k1+1)
                 if (stack != 0) 
                 {
-                    geometry.indices.insert(geometry.indices.end(), 
+                    indices.insert(indices.end(), 
                     {
                         static_cast<unsigned int>(k1),
                         static_cast<unsigned int>(k2),
@@ -59,7 +95,7 @@ namespace GeometryUtils
                     unsigned int nextK1 = (sector == sectors - 1) ? k1 - sector : k1 + 1;
                     unsigned int nextK2 = (sector == sectors - 1) ? k2 - sector : k2 + 1;
                     
-                    geometry.indices.insert(geometry.indices.end(), 
+                    indices.insert(indices.end(), 
                     {
                         nextK1,
                         static_cast<unsigned int>(k2),
@@ -67,8 +103,8 @@ namespace GeometryUtils
                     });
                 }
             }
-}
+        }
 
-        return geometry;
+        return SphereGeometry{vertices, indices};
     }
 }
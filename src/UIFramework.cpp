@@ -54,7 +54,11 @@ void UIFramework::Run()
 {
     // Create and initialize the renderer using your sphere configuration.
     std::unique_ptr<GeometryRenderer> renderer(new GeometryRenderer());
-    renderer->Initialize(sphereConfig);
+    GeometryUtils::GeometryArena sphereArena;
+    renderer->Initialize(createSphereConfig(sphereArena));
+
+    // Mesh data lives on the GPU now, drop the CPU copy
+    sphereArena.Release();
     
     glm::mat4 model = glm::mat4(1.0f); // No translation
     renderer->SetTransform(model);